@@ -25,6 +25,9 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 #include <media-io/video-scaler.h>
 #include <sstream>
 #include <string>
+#include <vector>
+#include <mutex>
+#include <cmath>
 
 using namespace cv;
 
@@ -40,8 +43,6 @@ struct aruco_data {
     obs_source_t *base_source;
     obs_scene_t *base_scene;
     obs_sceneitem_t *base_sceneitem;
-    vec2 bsource_pos;
-    vec2 bsource_scale;
 
     // helper references
     obs_source_t *search_source;
@@ -56,12 +57,6 @@ struct aruco_data {
     // settings
     int aruco_id;
     bool draw_marker;
-    bool show_only_when_marker;
-    int sceneitem_visibility_delay;
-    int visibility_delay_counter;
-    bool rotation_on;
-    bool scaling_on;
-    bool position_on;
 
     // aruco dict
     cv::Ptr<cv::aruco::Dictionary> dictionary;
@@ -74,25 +69,8 @@ struct aruco_data {
     uint32_t frame_counter;
     uint8_t skip;
 
-    // smoothing variables for easing
-    double easing_factor_pos;
-    double easing_factor_rot;
-    double easing_factor_scale;
-    double smooth_x, smooth_y;
-    double smooth_rotation;
-    double smooth_scale;
-    bool first_frame;
-
-    // marker state
-    bool marker_visible;
-    double mark_x;
-    double mark_y;
-    double mark_rotation;
-    double mark_size;
-    bool transform_dirty;
-
-    // scaling factor
-    double scaling_factor;
+    // slot in the tracker registry holding the marker, settings and smoothing state
+    size_t tracker_index;
 };
 
 
@@ -159,95 +137,511 @@ static double compute_alpha(double easing_factor, double seconds, double max_hal
     }
 }
 
-static void tick_callback(void *data, float seconds)
-{ 
-    struct aruco_data *filter = (aruco_data *)data;
 
-    if (!filter->marker_visible && filter->show_only_when_marker) {
-        filter->visibility_delay_counter++;
-        if (filter->visibility_delay_counter >= filter->sceneitem_visibility_delay) {
-            obs_sceneitem_set_visible(filter->scene_item, false);
-            filter->first_frame = true;
-            filter->visibility_delay_counter = 0;   
+//----Tracker Registry----//
+
+
+// Per tracker state the tick reads but does not ease. Published into the registry by
+// filter_update, filter_video and resolve_sources so the tick never touches aruco_data.
+struct tracker_info {
+    obs_sceneitem_t *scene_item;
+    obs_sceneitem_t *base_sceneitem;
+    bool has_source;
+    float short_side_size;
+
+    // settings
+    bool position_on;
+    bool rotation_on;
+    bool scaling_on;
+    bool show_only_when_marker;
+    int sceneitem_visibility_delay;
+    int visibility_delay_counter;
+    double scaling_factor;
+
+    // marker state
+    bool marker_visible;
+    bool first_frame;
+};
+
+// Settings copied from filter_update into the registry
+struct tracker_settings {
+    bool position_on;
+    bool rotation_on;
+    bool scaling_on;
+    bool show_only_when_marker;
+    int sceneitem_visibility_delay;
+    double scaling_factor;
+    double easing_factor_pos;
+    double easing_factor_rot;
+    double easing_factor_scale;
+};
+
+// A scene item update produced by the tick, applied after the registry lock is released.
+// The scene items hold a reference so the write stays valid if the filter is destroyed.
+struct tracker_write {
+    size_t tracker_index;
+    obs_sceneitem_t *scene_item;
+    obs_sceneitem_t *base_sceneitem;
+    bool set_visible;
+    bool visible;
+    bool set_transform;
+    bool position_on;
+    bool rotation_on;
+    bool scaling_on;
+    float short_side_size;
+    double scaling_factor;
+    double x, y;
+    double rotation;
+    double scale;
+};
+
+struct alpha_cache_entry {
+    double easing_factor;
+    double max_half_life;
+    double alpha;
+};
+
+// Plugin-wide list of every filter instance. The smoothing state lives here in
+// structure-of-arrays form so one tick callback can ease all trackers together.
+struct tracker_registry {
+    std::mutex mutex;
+    std::vector<aruco_data *> filters;
+    std::vector<tracker_info> info;
+
+    // easing targets, published by filter_video
+    std::vector<double> target_x, target_y;
+    std::vector<double> target_rotation;
+    std::vector<double> target_scale;
+
+    // smoothed transform, rotation kept wrapped to [-180, 180)
+    std::vector<double> smooth_x, smooth_y;
+    std::vector<double> smooth_rotation;
+    std::vector<double> smooth_scale;
+
+    // easing factors and the alphas derived from them
+    std::vector<double> easing_factor_pos, easing_factor_rot, easing_factor_scale;
+    std::vector<double> alpha_pos, alpha_rot, alpha_scale;
+
+    // per tick easing step (alpha when the axis is enabled and tracked, else 0)
+    std::vector<double> step_pos, step_rot, step_scale;
+
+    // alphas are only recomputed when the tick interval or an easing factor changes
+    std::vector<alpha_cache_entry> alpha_cache;
+    size_t alpha_cache_last;
+    float alpha_seconds;
+    bool alphas_dirty;
+
+    // only touched by the tick callback, so it is used outside the lock
+    std::vector<tracker_write> writes;
+};
+
+static tracker_registry trackers;
+
+
+template <typename T>
+static void swap_remove(std::vector<T> &column, size_t index)
+{
+    column[index] = column.back();
+    column.pop_back();
+}
+
+
+// Keeps an angle from atan2 in the [-180, 180) range used by the smoothed rotation
+static double wrap_rotation(double rotation)
+{
+    return rotation >= 180.0 ? rotation - 360.0 : rotation;
+}
+
+
+// Looks up the alpha for an easing factor, computing it only once per distinct value.
+// Neighbouring trackers usually share a factor, so the last hit is checked before searching.
+static double cached_alpha(tracker_registry *reg, double easing_factor, float seconds, double max_half_life)
+{
+    std::vector<alpha_cache_entry> &cache = reg->alpha_cache;
+
+    if (reg->alpha_cache_last < cache.size()) {
+        const alpha_cache_entry &last = cache[reg->alpha_cache_last];
+        if (last.easing_factor == easing_factor && last.max_half_life == max_half_life)
+            return last.alpha;
+    }
+
+    for (size_t i = 0; i < cache.size(); i++) {
+        if (cache[i].easing_factor == easing_factor && cache[i].max_half_life == max_half_life) {
+            reg->alpha_cache_last = i;
+            return cache[i].alpha;
         }
-        return;
     }
 
-    if (!filter->selected_source || !filter->scene_item)
-        return;
+    double alpha = compute_alpha(easing_factor, seconds, max_half_life);
+    reg->alpha_cache_last = cache.size();
+    cache.push_back({easing_factor, max_half_life, alpha});
+    return alpha;
+}
 
-    obs_sceneitem_set_visible(filter->scene_item, true);
 
-    // Compute alpha for this frame
-    double alpha_pos, alpha_rot, alpha_scale;
+static void tracker_registry_update_alphas(tracker_registry *reg, float seconds)
+{
+    size_t count = reg->filters.size();
 
-    alpha_pos = compute_alpha(filter->easing_factor_pos, seconds, MAX_HALF_LIFE_POS);
-    alpha_scale = compute_alpha(filter->easing_factor_scale, seconds, MAX_HALF_LIFE_SCALE);
-    alpha_rot = compute_alpha(filter->easing_factor_rot, seconds, MAX_HALF_LIFE_ROT);
+    reg->alpha_cache.clear();
+    reg->alpha_cache_last = 0;
 
-    if (filter->first_frame) {
-        filter->smooth_x = filter->mark_x;
-        filter->smooth_y = filter->mark_y;
-        filter->smooth_rotation = filter->mark_rotation;
-        filter->smooth_scale = filter->mark_size;
-        filter->first_frame = false;
+    for (size_t i = 0; i < count; i++) {
+        reg->alpha_pos[i] = cached_alpha(reg, reg->easing_factor_pos[i], seconds, MAX_HALF_LIFE_POS);
+        reg->alpha_rot[i] = cached_alpha(reg, reg->easing_factor_rot[i], seconds, MAX_HALF_LIFE_ROT);
+        reg->alpha_scale[i] = cached_alpha(reg, reg->easing_factor_scale[i], seconds, MAX_HALF_LIFE_SCALE);
     }
 
-    // Apply easing
-    if (filter->position_on) {
-        filter->smooth_x += (filter->mark_x - filter->smooth_x) * alpha_pos;
-        filter->smooth_y += (filter->mark_y - filter->smooth_y) * alpha_pos;
+    reg->alpha_seconds = seconds;
+    reg->alphas_dirty = false;
+}
+
+
+// Returns the slot of a filter, the registry lock must be held
+static bool tracker_registry_find(aruco_data *filter, size_t *index)
+{
+    *index = filter->tracker_index;
+    return *index < trackers.filters.size() && trackers.filters[*index] == filter;
+}
+
+
+static void tracker_registry_add(aruco_data *filter)
+{
+    std::lock_guard<std::mutex> lock(trackers.mutex);
+
+    tracker_info info = {};
+    info.position_on = true;
+    info.rotation_on = true;
+    info.scaling_on = true;
+    info.show_only_when_marker = true;
+    info.first_frame = true;
+
+    filter->tracker_index = trackers.filters.size();
+    trackers.filters.push_back(filter);
+    trackers.info.push_back(info);
+
+    trackers.target_x.push_back(0.0);
+    trackers.target_y.push_back(0.0);
+    trackers.target_rotation.push_back(0.0);
+    trackers.target_scale.push_back(0.0);
+    trackers.smooth_x.push_back(0.0);
+    trackers.smooth_y.push_back(0.0);
+    trackers.smooth_rotation.push_back(0.0);
+    trackers.smooth_scale.push_back(0.0);
+    trackers.easing_factor_pos.push_back(DEFAULT_EASING_FACTOR);
+    trackers.easing_factor_rot.push_back(DEFAULT_EASING_FACTOR);
+    trackers.easing_factor_scale.push_back(DEFAULT_EASING_FACTOR);
+    trackers.alpha_pos.push_back(0.0);
+    trackers.alpha_rot.push_back(0.0);
+    trackers.alpha_scale.push_back(0.0);
+    trackers.step_pos.push_back(0.0);
+    trackers.step_rot.push_back(0.0);
+    trackers.step_scale.push_back(0.0);
+
+    trackers.alphas_dirty = true;
+}
+
+
+static void tracker_registry_remove(aruco_data *filter)
+{
+    std::lock_guard<std::mutex> lock(trackers.mutex);
+
+    size_t index;
+    if (!tracker_registry_find(filter, &index))
+        return;
+
+    swap_remove(trackers.filters, index);
+    swap_remove(trackers.info, index);
+    swap_remove(trackers.target_x, index);
+    swap_remove(trackers.target_y, index);
+    swap_remove(trackers.target_rotation, index);
+    swap_remove(trackers.target_scale, index);
+    swap_remove(trackers.smooth_x, index);
+    swap_remove(trackers.smooth_y, index);
+    swap_remove(trackers.smooth_rotation, index);
+    swap_remove(trackers.smooth_scale, index);
+    swap_remove(trackers.easing_factor_pos, index);
+    swap_remove(trackers.easing_factor_rot, index);
+    swap_remove(trackers.easing_factor_scale, index);
+    swap_remove(trackers.alpha_pos, index);
+    swap_remove(trackers.alpha_rot, index);
+    swap_remove(trackers.alpha_scale, index);
+    swap_remove(trackers.step_pos, index);
+    swap_remove(trackers.step_rot, index);
+    swap_remove(trackers.step_scale, index);
+
+    // The last tracker was moved into the freed slot
+    if (index < trackers.filters.size())
+        trackers.filters[index]->tracker_index = index;
+}
+
+
+// Publishes the resolved scene items and source size of a filter
+static void tracker_registry_set_sources(aruco_data *filter)
+{
+    std::lock_guard<std::mutex> lock(trackers.mutex);
+
+    size_t index;
+    if (!tracker_registry_find(filter, &index))
+        return;
+
+    tracker_info &info = trackers.info[index];
+    info.scene_item = filter->scene_item;
+    info.base_sceneitem = filter->base_sceneitem;
+    info.has_source = filter->selected_source != NULL;
+    info.short_side_size = (float)std::min(filter->ssource_w, filter->ssource_h);
+}
+
+
+static void tracker_registry_set_settings(aruco_data *filter, const tracker_settings &settings)
+{
+    std::lock_guard<std::mutex> lock(trackers.mutex);
+
+    size_t index;
+    if (!tracker_registry_find(filter, &index))
+        return;
+
+    tracker_info &info = trackers.info[index];
+    info.position_on = settings.position_on;
+    info.rotation_on = settings.rotation_on;
+    info.scaling_on = settings.scaling_on;
+    info.show_only_when_marker = settings.show_only_when_marker;
+    info.sceneitem_visibility_delay = settings.sceneitem_visibility_delay;
+    info.scaling_factor = settings.scaling_factor;
+
+    trackers.easing_factor_pos[index] = settings.easing_factor_pos;
+    trackers.easing_factor_rot[index] = settings.easing_factor_rot;
+    trackers.easing_factor_scale[index] = settings.easing_factor_scale;
+    trackers.alphas_dirty = true;
+}
+
+
+// Publishes a detected marker as the new easing target
+static void tracker_registry_set_marker(aruco_data *filter, double x, double y, double rotation, double size)
+{
+    std::lock_guard<std::mutex> lock(trackers.mutex);
+
+    size_t index;
+    if (!tracker_registry_find(filter, &index))
+        return;
+
+    trackers.target_x[index] = x;
+    trackers.target_y[index] = y;
+    trackers.target_rotation[index] = wrap_rotation(rotation);
+    trackers.target_scale[index] = size;
+    trackers.info[index].marker_visible = true;
+}
+
+
+// Marks the marker as lost, easing the position back towards where it was last seen
+static void tracker_registry_set_marker_lost(aruco_data *filter, double last_x, double last_y)
+{
+    std::lock_guard<std::mutex> lock(trackers.mutex);
+
+    size_t index;
+    if (!tracker_registry_find(filter, &index))
+        return;
+
+    trackers.target_x[index] = last_x;
+    trackers.target_y[index] = last_y;
+    trackers.info[index].marker_visible = false;
+}
+
+
+// Handles visibility and picks the easing step of every tracker, queueing visibility writes
+static void tracker_registry_prepare(tracker_registry *reg)
+{
+    size_t count = reg->filters.size();
+
+    for (size_t i = 0; i < count; i++) {
+        tracker_info &info = reg->info[i];
+
+        reg->step_pos[i] = 0.0;
+        reg->step_rot[i] = 0.0;
+        reg->step_scale[i] = 0.0;
+
+        tracker_write write = {};
+        write.tracker_index = i;
+        write.scene_item = info.scene_item;
+
+        if (!info.marker_visible && info.show_only_when_marker) {
+            info.visibility_delay_counter++;
+            if (info.visibility_delay_counter >= info.sceneitem_visibility_delay) {
+                write.set_visible = true;
+                write.visible = false;
+                reg->writes.push_back(write);
+                info.first_frame = true;
+                info.visibility_delay_counter = 0;
+            }
+            continue;
+        }
+
+        if (!info.has_source || !info.scene_item)
+            continue;
+
+        if (info.first_frame) {
+            reg->smooth_x[i] = reg->target_x[i];
+            reg->smooth_y[i] = reg->target_y[i];
+            reg->smooth_rotation[i] = reg->target_rotation[i];
+            reg->smooth_scale[i] = reg->target_scale[i];
+            info.first_frame = false;
+        }
+
+        if (info.position_on)
+            reg->step_pos[i] = reg->alpha_pos[i];
+        if (info.rotation_on)
+            reg->step_rot[i] = reg->alpha_rot[i];
+        if (info.scaling_on)
+            reg->step_scale[i] = reg->alpha_scale[i];
+
+        write.base_sceneitem = info.base_sceneitem;
+        write.set_visible = true;
+        write.visible = true;
+        write.set_transform = true;
+        write.position_on = info.position_on;
+        write.rotation_on = info.rotation_on;
+        write.scaling_on = info.scaling_on;
+        write.short_side_size = info.short_side_size;
+        write.scaling_factor = info.scaling_factor;
+        reg->writes.push_back(write);
     }
+}
+
 
-    if (filter->scaling_on) {
-        filter->smooth_scale += (filter->mark_size - filter->smooth_scale) * alpha_scale;
+// Eases every tracker at once. Branch free so each loop vectorizes; trackers that are
+// inactive or have an axis disabled simply have a step of 0.
+static void tracker_registry_ease(tracker_registry *reg)
+{
+    size_t count = reg->filters.size();
+
+    double *__restrict smooth_x = reg->smooth_x.data();
+    double *__restrict smooth_y = reg->smooth_y.data();
+    double *__restrict smooth_rotation = reg->smooth_rotation.data();
+    double *__restrict smooth_scale = reg->smooth_scale.data();
+    const double *__restrict target_x = reg->target_x.data();
+    const double *__restrict target_y = reg->target_y.data();
+    const double *__restrict target_rotation = reg->target_rotation.data();
+    const double *__restrict target_scale = reg->target_scale.data();
+    const double *__restrict step_pos = reg->step_pos.data();
+    const double *__restrict step_rot = reg->step_rot.data();
+    const double *__restrict step_scale = reg->step_scale.data();
+
+#pragma omp simd
+    for (size_t i = 0; i < count; i++) {
+        smooth_x[i] += (target_x[i] - smooth_x[i]) * step_pos[i];
+        smooth_y[i] += (target_y[i] - smooth_y[i]) * step_pos[i];
     }
 
-    if (filter->rotation_on) {
-        double delta_rotation = filter->mark_rotation - filter->smooth_rotation;
-        while (delta_rotation > 180) delta_rotation -= 360;
-        while (delta_rotation < -180) delta_rotation += 360;
-        filter->smooth_rotation += delta_rotation * alpha_rot;
+#pragma omp simd
+    for (size_t i = 0; i < count; i++) {
+        smooth_scale[i] += (target_scale[i] - smooth_scale[i]) * step_scale[i];
     }
 
-    // Apply to OBS scene item
-    obs_sceneitem_get_pos(filter->base_sceneitem, &filter->bsource_pos);
-    obs_sceneitem_get_scale(filter->base_sceneitem, &filter->bsource_scale);
+    // Both angles are in [-180, 180), so a single correction each way takes the
+    // difference and the result back into range without a floor or loop
+#pragma omp simd
+    for (size_t i = 0; i < count; i++) {
+        double delta_rotation = target_rotation[i] - smooth_rotation[i];
+        delta_rotation = delta_rotation >= 180.0 ? delta_rotation - 360.0 : delta_rotation;
+        delta_rotation = delta_rotation < -180.0 ? delta_rotation + 360.0 : delta_rotation;
+
+        double rotation = smooth_rotation[i] + delta_rotation * step_rot[i];
+        rotation = rotation >= 180.0 ? rotation - 360.0 : rotation;
+        rotation = rotation < -180.0 ? rotation + 360.0 : rotation;
+        smooth_rotation[i] = rotation;
+    }
+}
 
-    struct vec2 pos;
-    pos.x = (float)filter->smooth_x * filter->bsource_scale.x + filter->bsource_pos.x;
-    pos.y = (float)filter->smooth_y * filter->bsource_scale.y + filter->bsource_pos.y;
 
-    struct vec2 orig_size;
-    orig_size.x = (float)filter->ssource_w;
-    orig_size.y = (float)filter->ssource_h;
+// Copies the smoothed transforms into the queued writes and takes scene item references
+static void tracker_registry_collect(tracker_registry *reg)
+{
+    for (tracker_write &write : reg->writes) {
+        obs_sceneitem_addref(write.scene_item);
+        obs_sceneitem_addref(write.base_sceneitem);
+
+        if (!write.set_transform)
+            continue;
+
+        size_t i = write.tracker_index;
+        write.x = reg->smooth_x[i];
+        write.y = reg->smooth_y[i];
+        write.rotation = reg->smooth_rotation[i];
+        write.scale = reg->smooth_scale[i];
+    }
+}
 
-    float short_side_size = std::min(orig_size.x, orig_size.y);
 
-    struct vec2 obs_scale_factor;
-    obs_scale_factor.x = ((float)filter->smooth_scale / short_side_size) * filter->bsource_scale.x;
-    obs_scale_factor.y = ((float)filter->smooth_scale / short_side_size) * filter->bsource_scale.y;
+// Sends the queued writes to OBS. Runs without the registry lock, since these calls
+// take scene locks and emit signals that must not block filter create, update or destroy.
+static void tracker_registry_apply(tracker_registry *reg)
+{
+    for (const tracker_write &write : reg->writes) {
+        if (write.set_visible)
+            obs_sceneitem_set_visible(write.scene_item, write.visible);
+
+        if (write.set_transform) {
+            struct vec2 bsource_pos;
+            struct vec2 bsource_scale;
+            obs_sceneitem_get_pos(write.base_sceneitem, &bsource_pos);
+            obs_sceneitem_get_scale(write.base_sceneitem, &bsource_scale);
+
+            struct vec2 pos;
+            pos.x = (float)write.x * bsource_scale.x + bsource_pos.x;
+            pos.y = (float)write.y * bsource_scale.y + bsource_pos.y;
+
+            struct vec2 obs_scale_factor;
+            obs_scale_factor.x = ((float)write.scale / write.short_side_size) * bsource_scale.x;
+            obs_scale_factor.y = ((float)write.scale / write.short_side_size) * bsource_scale.y;
+
+            obs_scale_factor.x += obs_scale_factor.x * (float)write.scaling_factor;
+            obs_scale_factor.y += obs_scale_factor.y * (float)write.scaling_factor;
+
+            if (obs_scale_factor.x < 0 || obs_scale_factor.y < 0) {
+                obs_scale_factor.x = 0;
+                obs_scale_factor.y = 0;
+            }
 
-    obs_scale_factor.x += obs_scale_factor.x * (float)filter->scaling_factor;
-    obs_scale_factor.y += obs_scale_factor.y * (float)filter->scaling_factor;
+            // Send to OBS
+            if (write.position_on) {
+                obs_sceneitem_set_pos(write.scene_item, &pos);
+            }
+            if (write.scaling_on) {
+                obs_sceneitem_set_scale(write.scene_item, &obs_scale_factor);
+            }
+            if (write.rotation_on) {
+                obs_sceneitem_set_rot(write.scene_item, (float)write.rotation);
+            }
+        }
 
-    if (obs_scale_factor.x < 0 || obs_scale_factor.y < 0) {
-        obs_scale_factor.x = 0;
-        obs_scale_factor.y = 0;
+        obs_sceneitem_release(write.scene_item);
+        obs_sceneitem_release(write.base_sceneitem);
     }
 
-    // Send to OBS
-    if (filter->position_on) {
-        obs_sceneitem_set_pos(filter->scene_item, &pos);
-    }
-    if (filter->scaling_on) {
-        obs_sceneitem_set_scale(filter->scene_item, &obs_scale_factor);
-    }
-    if (filter->rotation_on) {
-        obs_sceneitem_set_rot(filter->scene_item, (float)filter->smooth_rotation);
+    reg->writes.clear();
+}
+
+
+// Single tick callback for the whole plugin, registered on module load
+static void tick_callback(void *data, float seconds)
+{
+    struct tracker_registry *reg = (tracker_registry *)data;
+
+    {
+        std::lock_guard<std::mutex> lock(reg->mutex);
+
+        if (reg->filters.empty())
+            return;
+
+        if (reg->alphas_dirty || seconds != reg->alpha_seconds)
+            tracker_registry_update_alphas(reg, seconds);
+
+        tracker_registry_prepare(reg);
+        tracker_registry_ease(reg);
+        tracker_registry_collect(reg);
     }
 
-    filter->transform_dirty = false;
+    tracker_registry_apply(reg);
 }
 
 
@@ -299,6 +693,7 @@ static void resolve_sources(aruco_data *filter)
     resolve_selected_sceneitem(filter, filter->base_source);
     filter->base_source = filter->search_source;
     filter->base_sceneitem = filter->search_sceneitem;
+    tracker_registry_set_sources(filter);
 }
 
 
@@ -322,39 +717,19 @@ static void *filter_create(obs_data_t *settings, obs_source_t *source)
     filter->selected_source = NULL;
     filter->scene_item = NULL;
     filter->base_source = NULL;
-    
+
+    tracker_registry_add(filter);
     resolve_sources(filter);
 
     filter->dictionary = cv::makePtr<cv::aruco::Dictionary>(cv::aruco::getPredefinedDictionary(cv::aruco::DICT_4X4_50));
     filter->draw_marker = false;
-    filter->show_only_when_marker = true;
-    filter->sceneitem_visibility_delay = 0;
-    filter->visibility_delay_counter = 0;
     filter->aruco_id = 0;
     filter->scaler_simple = NULL;
     filter->last_x = 0.0;
     filter->last_y = 0.0;
     filter->frame_counter = 0;
     filter->skip = 0;
-    filter->scaling_factor = 0.00;
-    filter->marker_visible = false;
-    filter->mark_x = 0.0;
-    filter->mark_y = 0.0;
-    filter->mark_size = 0.0;
-    filter->mark_rotation = 0.0;
-    filter->rotation_on = true;
-    filter->scaling_on = true;
-    filter->position_on = true;
-    filter->first_frame = true;
-    filter->easing_factor_pos = 0.20;
-    filter->easing_factor_rot = 0.20;
-    filter->easing_factor_scale = 0.20;
-    filter->smooth_x = 0.0;
-    filter->smooth_y = 0.0;
-    filter->smooth_rotation = 0.0;
-    filter->smooth_scale = 0.0;
-
-    obs_add_tick_callback(tick_callback, filter);
+
     obs_source_update(source, settings);
 
     return filter;
@@ -371,13 +746,13 @@ static void filter_activate(void *data)
 static void filter_destroy(void *data)
 {
     struct aruco_data *filter = (struct aruco_data *)data;
+    tracker_registry_remove(filter);
     if (filter->scaler_simple)
         video_scaler_destroy(filter->scaler_simple);
     if (filter->selected_source)
         obs_source_release(filter->selected_source);
     if (filter->source)
         obs_source_release(filter->source);
-    obs_remove_tick_callback(tick_callback, filter);
     bfree(filter);
 }
 
@@ -392,6 +767,7 @@ static struct obs_source_frame *filter_video(void *data, struct obs_source_frame
             resolve_selected_sceneitem(filter, filter->base_source);
             filter->base_source = filter->search_source;
             filter->base_sceneitem = filter->search_sceneitem;
+            tracker_registry_set_sources(filter);
         }
     }
 
@@ -456,21 +832,14 @@ static struct obs_source_frame *filter_video(void *data, struct obs_source_frame
 
                 double edge_len = cv::norm(v);
                 
-                filter->mark_x = cx;
-                filter->mark_y = cy;
                 filter->last_x = cx;
                 filter->last_y = cy;
-                filter->mark_rotation = rotation_deg;
-                filter->mark_size = edge_len;
-                filter->marker_visible = true;
-                filter->transform_dirty = true;
+                tracker_registry_set_marker(filter, cx, cy, rotation_deg, edge_len);
 
                 break;
             }
         } else {
-            filter->mark_x = filter->last_x;
-            filter->mark_y = filter->last_y;
-            filter->marker_visible = false;
+            tracker_registry_set_marker_lost(filter, filter->last_x, filter->last_y);
         }
     } else {
         obs_log(LOG_INFO, "ArUco Source Move: Image data missing or failed to load.");
@@ -503,17 +872,21 @@ static void filter_update(void *data, obs_data_t *settings)
     double easing_factor_scale = obs_data_get_double(settings, SCALING_EASING_FACTOR);
 
     filter->aruco_id = id;
-    filter->scaling_on = scaling_on;
-    filter->rotation_on = rotation_on;
-    filter->position_on = position_on;
     filter->draw_marker = draw_marker;
-    filter->show_only_when_marker = show_only_when_marker;
-    filter->sceneitem_visibility_delay = visibility_delay;
     filter->skip = skip_frames;
-    filter->scaling_factor = scaling_factor;
-    filter->easing_factor_pos = easing_factor_pos;
-    filter->easing_factor_rot = easing_factor_rot;
-    filter->easing_factor_scale = easing_factor_scale;
+
+    struct tracker_settings tracker;
+    tracker.position_on = position_on;
+    tracker.rotation_on = rotation_on;
+    tracker.scaling_on = scaling_on;
+    tracker.show_only_when_marker = show_only_when_marker;
+    tracker.sceneitem_visibility_delay = visibility_delay;
+    tracker.scaling_factor = scaling_factor;
+    tracker.easing_factor_pos = easing_factor_pos;
+    tracker.easing_factor_rot = easing_factor_rot;
+    tracker.easing_factor_scale = easing_factor_scale;
+
+    tracker_registry_set_settings(filter, tracker);
 }
 
 
@@ -601,6 +974,7 @@ extern "C" struct obs_source_info filter_info = {
 bool obs_module_load(void)
 {
     obs_register_source(&filter_info);
+    obs_add_tick_callback(tick_callback, &trackers);
 
 	obs_log(LOG_INFO, "plugin loaded successfully (version %s)", PLUGIN_VERSION);
 
@@ -610,6 +984,7 @@ bool obs_module_load(void)
 
 void obs_module_unload(void)
 {
+    obs_remove_tick_callback(tick_callback, &trackers);
 	obs_log(LOG_INFO, "ArUco Source Move: Plugin unloaded.");
 }
 